@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef MVPU_DEBUG_INFO_ADDR_INDEX_H
+#define MVPU_DEBUG_INFO_ADDR_INDEX_H
+
+#include "MVPU_DebugInfo/DebugInfoList.h"
+
+#include "MVPU_ELF/ELF.h"
+
+#include "absl/hash/hash.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace mvpu_debuginfo
+{
+
+const char * const TEXT_SECTION_NAME = ".text";
+
+// Maps an absolute (relocated) PC to the DebugInfoID and ELF whose text
+// covers it. Entries are ordered by relocated start and also reachable by
+// id, so lookups and per-id updates are O(log n). Relocated text ranges
+// must not overlap.
+//
+// The index holds ELF pointers into the list; call update() after
+// DebugInfoList::add / setSectionAddr for that id, and build() again after
+// merge, update, clear or DebugInfoJournal::apply (which erases entries).
+class AddrIndex
+{
+public:
+    struct Entry
+    {
+        std::uint32_t begin;
+        std::uint64_t end; // exclusive
+        DebugInfoID id;
+        ELF *elf;
+    };
+
+    explicit AddrIndex(std::string textSec = TEXT_SECTION_NAME) : textSec(std::move(textSec)) {}
+
+    // entries are referenced by iterator from byID
+    AddrIndex(const AddrIndex &) = delete;
+
+    AddrIndex(AddrIndex &&) = default;
+
+    AddrIndex & operator=(const AddrIndex &) = delete;
+
+    AddrIndex & operator=(AddrIndex &&) = default;
+
+    std::size_t size() const { return entries.size(); }
+
+    bool empty() const { return entries.empty(); }
+
+    void clear()
+    {
+        entries.clear();
+        byID.clear();
+    }
+
+    void build(DebugInfoList &list)
+    {
+        clear();
+        byID.reserve(list.size());
+        for (auto &pair : list.infoMap)
+            insert(pair.first, pair.second);
+    }
+
+    // re-reads one id from the list; drops it if the id is gone or its
+    // text has no address yet
+    void update(DebugInfoList &list, const DebugInfoID &id)
+    {
+        remove(id);
+
+        auto it = list.infoMap.find(id);
+        if (it != list.infoMap.end())
+            insert(it->first, it->second);
+    }
+
+    void remove(const DebugInfoID &id)
+    {
+        auto it = byID.find(id);
+        if (it == byID.end())
+            return;
+
+        entries.erase(it->second);
+        byID.erase(it);
+    }
+
+    // entry whose relocated text contains pc, or nullptr
+    const Entry * find(std::uint32_t pc) const
+    {
+        auto it = entries.upper_bound(pc);
+        if (it == entries.begin())
+            return nullptr;
+        --it;
+        if (pc >= it->second.end)
+            return nullptr;
+        return &it->second;
+    }
+
+    // pc translated into the ELF's own text address space
+    static std::uint32_t toELFAddr(const Entry &entry, std::uint32_t pc)
+    {
+        return pc - entry.begin + entry.elf->getTextAddr();
+    }
+
+private:
+    using EntryMap = std::multimap<std::uint32_t, Entry>;
+
+    void insert(const DebugInfoID &id, RelocELF &reloc)
+    {
+        auto addr = reloc.secAddrs.find(textSec);
+        if (addr == reloc.secAddrs.end() || !reloc.elf.hasText())
+            return;
+
+        auto size = reloc.elf.getText().size();
+        if (size == 0)
+            return;
+
+        Entry entry;
+        entry.begin = addr->second;
+        entry.end = std::uint64_t(addr->second) + size;
+        entry.id = id;
+        entry.elf = &reloc.elf;
+
+        byID[id] = entries.emplace(entry.begin, entry);
+    }
+
+    std::string textSec;
+    EntryMap entries;
+    std::unordered_map<DebugInfoID, EntryMap::iterator, absl::Hash<DebugInfoID>> byID;
+}; // class AddrIndex
+
+} // namespace mvpu_debuginfo
+
+#endif // MVPU_DEBUG_INFO_ADDR_INDEX_H
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef MVPU_DEBUG_INFO_CONCURRENT_DEBUG_INFO_LIST_H
+#define MVPU_DEBUG_INFO_CONCURRENT_DEBUG_INFO_LIST_H
+
+#include "MVPU_DebugInfo/AddrIndex.h"
+#include "MVPU_DebugInfo/DebugInfoList.h"
+
+#include "absl/hash/hash.h"
+#include "absl/types/span.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+namespace mvpu_debuginfo
+{
+
+// DebugInfoList split into independently locked shards by id. Writers to
+// different shards never contend, and readers (find, getSectionAddr,
+// findPC) only take shared locks, so they run alongside each other and
+// alongside writers to other shards.
+//
+// Returned ELF pointers stay valid until take() or clear().
+class ConcurrentDebugInfoList
+{
+public:
+    static const std::size_t SHARD_COUNT = 16;
+
+    ConcurrentDebugInfoList() = default;
+
+    ConcurrentDebugInfoList(const ConcurrentDebugInfoList &) = delete;
+
+    ConcurrentDebugInfoList & operator=(const ConcurrentDebugInfoList &) = delete;
+
+    ELF * add(const DebugInfoID &id, ELF &&elf)
+    {
+        auto &shard = shardOf(id);
+        std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+        auto *res = shard.list.add(id, std::move(elf));
+        shard.index.update(shard.list, id);
+        return res;
+    }
+
+    ELF * find(const DebugInfoID &id)
+    {
+        auto &shard = shardOf(id);
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+        return shard.list.find(id);
+    }
+
+    std::uint32_t getSectionAddr(const DebugInfoID &id, const std::string &sec)
+    {
+        auto &shard = shardOf(id);
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+        return shard.list.getSectionAddr(id, sec);
+    }
+
+    void setSectionAddr(const DebugInfoID &id, const std::string &sec, std::uint32_t addr)
+    {
+        auto &shard = shardOf(id);
+        std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+        shard.list.setSectionAddr(id, sec, addr);
+        shard.index.update(shard.list, id);
+    }
+
+    bool setSectionAddrs(const DebugInfoID &id, absl::Span<const RelocELF::SectionAddr> addrs)
+    {
+        auto &shard = shardOf(id);
+        std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+        if (!shard.list.setSectionAddrs(id, addrs))
+            return false;
+        shard.index.update(shard.list, id);
+        return true;
+    }
+
+    // id and ELF whose relocated text contains pc
+    bool findPC(std::uint32_t pc, DebugInfoID &id, ELF *&elf)
+    {
+        for (auto &shard : shards)
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+            auto *entry = shard.index.find(pc);
+            if (entry)
+            {
+                id = entry->id;
+                elf = entry->elf;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::size_t size()
+    {
+        std::size_t total = 0;
+        for (auto &shard : shards)
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+            total += shard.list.size();
+        }
+        return total;
+    }
+
+    void clear()
+    {
+        for (auto &shard : shards)
+        {
+            std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+            shard.list.clear();
+            shard.index.clear();
+        }
+    }
+
+    // Moves every entry into `all`, e.g. for serialization. If a merge
+    // fails, take() stops there and returns false; entries the merge did
+    // not move stay in their shard and remain findable.
+    bool take(DebugInfoList &all)
+    {
+        for (auto &shard : shards)
+        {
+            std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+            if (!all.merge(shard.list))
+            {
+                shard.index.build(shard.list);
+                return false;
+            }
+            shard.list.clear();
+            shard.index.clear();
+        }
+        return true;
+    }
+
+private:
+    struct Shard
+    {
+        std::shared_timed_mutex mutex;
+        DebugInfoList list;
+        AddrIndex index;
+    };
+
+    Shard & shardOf(const DebugInfoID &id)
+    {
+        return shards[absl::Hash<DebugInfoID>{}(id) % SHARD_COUNT];
+    }
+
+    Shard shards[SHARD_COUNT];
+}; // class ConcurrentDebugInfoList
+
+} // namespace mvpu_debuginfo
+
+#endif // MVPU_DEBUG_INFO_CONCURRENT_DEBUG_INFO_LIST_H
@@ -10,7 +10,9 @@
 
 #include "absl/types/span.h"
 
+#include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace mvpu_debuginfo
 {
@@ -18,6 +20,9 @@ namespace mvpu_debuginfo
 using ::mvpu_elf::DebugInfoID;
 using ::mvpu_elf::ELF;
 
+class AddrIndex;
+class DebugInfoJournal;
+
 struct DebugInfoNewID
 {
     DebugInfoID old;
@@ -27,6 +32,7 @@ struct DebugInfoNewID
 struct RelocELF
 {
     using SectionAddrMap = std::unordered_map<std::string, std::uint32_t>;
+    using SectionAddr = std::pair<std::string, std::uint32_t>;
 
     MVPU_DBG_ENTRY
     RelocELF() = default;
@@ -119,9 +125,35 @@ public:
     MVPU_DBG_ENTRY
     void setSectionAddr(const DebugInfoID &id, const std::string &sec, std::uint32_t addr);
 
+    // all section addresses of id in one lookup, nullptr if id is unknown
+    MVPU_DBG_ENTRY
+    const RelocELF::SectionAddrMap * getSectionAddrs(const DebugInfoID &id) const
+    {
+        auto it = infoMap.find(id);
+        return it == infoMap.end() ? nullptr : &it->second.secAddrs;
+    }
+
+    // sets several section addresses of id in one lookup, false if id is unknown
+    MVPU_DBG_ENTRY
+    bool setSectionAddrs(const DebugInfoID &id, absl::Span<const RelocELF::SectionAddr> addrs)
+    {
+        auto it = infoMap.find(id);
+        if (it == infoMap.end())
+            return false;
+
+        auto &secAddrs = it->second.secAddrs;
+        secAddrs.reserve(secAddrs.size() + addrs.size());
+        for (auto &addr : addrs)
+            secAddrs[addr.first] = addr.second;
+        return true;
+    }
+
     friend ::prime_lib::serialize::Encodable<IDELFMap>;
     friend ::prime_lib::serialize::Decodable<IDELFMap>;
 
+    friend AddrIndex;
+    friend DebugInfoJournal;
+
     friend ::prime_lib::serialize::Encodable<DebugInfoList>;
     friend ::prime_lib::serialize::Decodable<DebugInfoList>;
 
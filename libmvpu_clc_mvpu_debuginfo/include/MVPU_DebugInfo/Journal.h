@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef MVPU_DEBUG_INFO_JOURNAL_H
+#define MVPU_DEBUG_INFO_JOURNAL_H
+
+#include "MVPU_DebugInfo/DebugInfoList.h"
+
+#include "PrimeLib/Serialize.h"
+
+#include "absl/types/span.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mvpu_debuginfo
+{
+
+// One change to a DebugInfoList. Only the fields of its kind are used.
+struct JournalRecord
+{
+    enum Kind : std::uint8_t
+    {
+        ADD = 0,
+        UPDATE,
+        SET_SECTION_ADDR,
+        REMOVE,
+    } kind = ADD;
+
+    DebugInfoID id{};                   // ADD, SET_SECTION_ADDR, REMOVE
+    RelocELF reloc;                     // ADD
+    std::vector<DebugInfoNewID> newIDs; // UPDATE
+    std::string sec;                    // SET_SECTION_ADDR
+    std::uint32_t addr = 0;             // SET_SECTION_ADDR
+};
+
+// Append-only log of DebugInfoList changes. Its encoding is a plain
+// sequence of records, so the encoding of a newer journal can be appended
+// after an encoded DebugInfoList (or after earlier journals) and the whole
+// tail decodes as one journal. Replaying it with apply() on the decoded
+// list and encoding the list again compacts the file.
+//
+// mvpuDbgRead does not know about journals: it decodes the list and stops
+// without checking for trailing bytes, so on a file with a journal
+// appended it silently returns the list as it was before the journal.
+// Compact such files before handing them to mvpuDbgRead readers.
+class DebugInfoJournal
+{
+public:
+    using size_type = std::vector<JournalRecord>::size_type;
+
+    DebugInfoJournal() = default;
+
+    DebugInfoJournal(const DebugInfoJournal &) = delete;
+
+    DebugInfoJournal(DebugInfoJournal &&) = default;
+
+    DebugInfoJournal & operator=(const DebugInfoJournal &) = delete;
+
+    DebugInfoJournal & operator=(DebugInfoJournal &&) = default;
+
+    size_type size() const { return records.size(); }
+
+    bool empty() const { return records.empty(); }
+
+    void clear() { records.clear(); }
+
+    // adds id, replacing the entry already stored under it (e.g. a
+    // recompiled kernel)
+    void add(const DebugInfoID &id, RelocELF &&reloc)
+    {
+        JournalRecord rec;
+        rec.kind = JournalRecord::ADD;
+        rec.id = id;
+        rec.reloc = std::move(reloc);
+        records.push_back(std::move(rec));
+    }
+
+    void remove(const DebugInfoID &id)
+    {
+        JournalRecord rec;
+        rec.kind = JournalRecord::REMOVE;
+        rec.id = id;
+        records.push_back(std::move(rec));
+    }
+
+    void update(absl::Span<const DebugInfoNewID> idList)
+    {
+        JournalRecord rec;
+        rec.kind = JournalRecord::UPDATE;
+        rec.newIDs.assign(idList.begin(), idList.end());
+        records.push_back(std::move(rec));
+    }
+
+    void setSectionAddr(const DebugInfoID &id, const std::string &sec, std::uint32_t addr)
+    {
+        JournalRecord rec;
+        rec.kind = JournalRecord::SET_SECTION_ADDR;
+        rec.id = id;
+        rec.sec = sec;
+        rec.addr = addr;
+        records.push_back(std::move(rec));
+    }
+
+    // Replays the records in order, moving added ELFs into the list, and
+    // consumes the journal. Stops at the first record the list rejects;
+    // the records before it stay applied.
+    bool apply(DebugInfoList &list) &&
+    {
+        auto recs = std::move(records);
+        records.clear();
+
+        for (auto &rec : recs)
+        {
+            switch (rec.kind)
+            {
+            default: return false;
+            case JournalRecord::ADD:
+                // DebugInfoList::add keeps an existing entry, so replace it here
+                list.infoMap.erase(rec.id);
+                list.infoMap.emplace(rec.id, std::move(rec.reloc));
+                break;
+            case JournalRecord::UPDATE:
+                if (!list.update(rec.newIDs))
+                    return false;
+                break;
+            case JournalRecord::SET_SECTION_ADDR:
+                list.setSectionAddr(rec.id, rec.sec, rec.addr);
+                break;
+            case JournalRecord::REMOVE:
+                if (list.infoMap.erase(rec.id) == 0)
+                    return false;
+                break;
+            }
+        }
+        return true;
+    }
+
+    friend ::prime_lib::serialize::Encodable<DebugInfoJournal>;
+    friend ::prime_lib::serialize::Decodable<DebugInfoJournal>;
+
+private:
+    std::vector<JournalRecord> records;
+}; // class DebugInfoJournal
+
+} // namespace mvpu_debuginfo
+
+#endif // MVPU_DEBUG_INFO_JOURNAL_H
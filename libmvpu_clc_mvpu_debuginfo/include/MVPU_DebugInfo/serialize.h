@@ -3,6 +3,7 @@
 #define MVPU_DEBUG_INFO_SERIALIZE_H
 
 #include "MVPU_DebugInfo/DebugInfoList.h"
+#include "MVPU_DebugInfo/Journal.h"
 
 #include "MVPU_ELF/serialize.h"
 
@@ -107,7 +108,12 @@ struct Decodable<::mvpu_debuginfo::DebugInfoList::IDELFMap>
 
         return d.template readMap<ValTy>([](D &mapD, std::size_t len)
         {
+            // len comes from the input; cap the reservation so a corrupt
+            // count fails on the first missing entry instead of allocating
+            const std::size_t maxReserve = 4096;
+
             ValTy map;
+            map.reserve(len < maxReserve ? len : maxReserve);
             for (unsigned i = 0; i < len; ++i)
             {
                 auto key = mapD.template readMapKey<Key>(i, [](D &keyD) { return Decodable<Key>::decode(keyD); });
@@ -154,6 +160,182 @@ struct Decodable<::mvpu_debuginfo::DebugInfoList>
     }
 };
 
+// JournalRecord::Kind
+template <>
+struct Encodable<::mvpu_debuginfo::JournalRecord::Kind>
+{
+    using ValTy = ::mvpu_debuginfo::JournalRecord::Kind;
+    template<typename E, typename RetTy = Result<Unit, typename E::ErrTy>>
+    static RetTy encode(ValTy kind, E &e)
+    {
+        auto val = static_cast<unsigned char>(kind);
+        PRIME_LIB_TRYV(ENCODE_V(val, e));
+
+        return RetTy::Ok(Unit{});
+    }
+};
+
+template<>
+struct Decodable<::mvpu_debuginfo::JournalRecord::Kind>
+{
+    using ValTy = ::mvpu_debuginfo::JournalRecord::Kind;
+    template<typename D, typename RetTy = Result<ValTy, typename D::ErrTy>>
+    static RetTy decode(D &d)
+    {
+        PRIME_LIB_TRY(kind, DECODE_T(unsigned char, d));
+
+        return RetTy::Ok(static_cast<ValTy>(kind));
+    }
+};
+
+// JournalRecord
+template <>
+struct Encodable<::mvpu_debuginfo::JournalRecord>
+{
+    using ValTy = ::mvpu_debuginfo::JournalRecord;
+    template<typename E, typename RetTy = Result<Unit, typename E::ErrTy>>
+    static RetTy encode(ValTy &rec, E &e)
+    {
+        using ErrTy = typename E::ErrTy;
+
+        PRIME_LIB_TRYV(ENCODE_V(rec.kind, e));
+
+        switch (rec.kind)
+        {
+        default: return RetTy::Err(ErrTy{});
+        case ValTy::ADD:
+            PRIME_LIB_TRYV(ENCODE_V(rec.id, e));
+            PRIME_LIB_TRYV(ENCODE_V(rec.reloc, e));
+            break;
+        case ValTy::UPDATE:
+        {
+            auto count = static_cast<std::uint32_t>(rec.newIDs.size());
+            PRIME_LIB_TRYV(ENCODE_V(count, e));
+            for (auto &newID : rec.newIDs)
+            {
+                PRIME_LIB_TRYV(ENCODE_V(newID.old, e));
+                PRIME_LIB_TRYV(ENCODE_V(newID.new_, e));
+            }
+            break;
+        }
+        case ValTy::SET_SECTION_ADDR:
+            PRIME_LIB_TRYV(ENCODE_V(rec.id, e));
+            PRIME_LIB_TRYV(ENCODE_V(rec.sec, e));
+            PRIME_LIB_TRYV(ENCODE_V(rec.addr, e));
+            break;
+        case ValTy::REMOVE:
+            PRIME_LIB_TRYV(ENCODE_V(rec.id, e));
+            break;
+        }
+
+        return RetTy::Ok(Unit{});
+    }
+};
+
+template<>
+struct Decodable<::mvpu_debuginfo::JournalRecord>
+{
+    using ValTy = ::mvpu_debuginfo::JournalRecord;
+    template<typename D, typename RetTy = Result<ValTy, typename D::ErrTy>>
+    static RetTy decode(D &d)
+    {
+        using ErrTy = typename D::ErrTy;
+
+        ValTy rec;
+
+        PRIME_LIB_TRY(kind, DECODE_V(rec.kind, d));
+
+        rec.kind = kind;
+
+        switch (rec.kind)
+        {
+        default: return RetTy::Err(ErrTy{});
+        case ValTy::ADD:
+        {
+            PRIME_LIB_TRY(id   , DECODE_V(rec.id, d));
+            PRIME_LIB_TRY(reloc, DECODE_V(rec.reloc, d));
+
+            rec.id = id;
+            rec.reloc = std::move(reloc);
+            break;
+        }
+        case ValTy::UPDATE:
+        {
+            PRIME_LIB_TRY(count, DECODE_T(std::uint32_t, d));
+
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                ::mvpu_debuginfo::DebugInfoNewID newID;
+
+                PRIME_LIB_TRY(old , DECODE_V(newID.old, d));
+                PRIME_LIB_TRY(new_, DECODE_V(newID.new_, d));
+
+                newID.old = old;
+                newID.new_ = new_;
+                rec.newIDs.push_back(newID);
+            }
+            break;
+        }
+        case ValTy::SET_SECTION_ADDR:
+        {
+            PRIME_LIB_TRY(id  , DECODE_V(rec.id, d));
+            PRIME_LIB_TRY(sec , DECODE_V(rec.sec, d));
+            PRIME_LIB_TRY(addr, DECODE_V(rec.addr, d));
+
+            rec.id = id;
+            rec.sec = std::move(sec);
+            rec.addr = addr;
+            break;
+        }
+        case ValTy::REMOVE:
+        {
+            PRIME_LIB_TRY(id, DECODE_V(rec.id, d));
+
+            rec.id = id;
+            break;
+        }
+        }
+
+        return RetTy::Ok(std::move(rec));
+    }
+};
+
+// DebugInfoJournal
+template <>
+struct Encodable<::mvpu_debuginfo::DebugInfoJournal>
+{
+    using ValTy = ::mvpu_debuginfo::DebugInfoJournal;
+    template<typename E, typename RetTy = Result<Unit, typename E::ErrTy>>
+    static RetTy encode(ValTy &journal, E &e)
+    {
+        for (auto &rec : journal.records)
+        {
+            PRIME_LIB_TRYV(ENCODE_V(rec, e));
+        }
+        return RetTy::Ok(Unit{});
+    }
+};
+
+template<>
+struct Decodable<::mvpu_debuginfo::DebugInfoJournal>
+{
+    using ValTy = ::mvpu_debuginfo::DebugInfoJournal;
+    template<typename D, typename RetTy = Result<ValTy, typename D::ErrTy>>
+    static RetTy decode(D &d)
+    {
+        ValTy journal;
+
+        while (true)
+        {
+            if (d.isEOF())
+                break;
+            PRIME_LIB_TRY(rec, DECODE_T(::mvpu_debuginfo::JournalRecord, d));
+            journal.records.push_back(std::move(rec));
+        }
+        return RetTy::Ok(std::move(journal));
+    }
+};
+
 #undef DECODE_V
 #undef DECODE_T
 
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef MVPU_ELF_BATCH_LOAD_H
+#define MVPU_ELF_BATCH_LOAD_H
+
+#include "MVPU_ELF/ELF.h"
+
+#include "absl/base/macros.h"
+#include "absl/types/span.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace mvpu_elf
+{
+
+// Loads every blob with ELF::load, spread over up to `threads` workers
+// (0 picks the hardware concurrency). The result has one entry per input,
+// in input order, and an entry is None when that blob failed to load.
+inline std::vector<ELF::ELFOpt> loadAll(absl::Span<const ELF::RawData> bufs, unsigned threads = 0)
+{
+    std::vector<ELF::ELFOpt> elfs;
+    elfs.reserve(bufs.size());
+    for (std::size_t i = 0; i < bufs.size(); ++i)
+        elfs.push_back(ELF::ELFOpt::None());
+
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned>(std::min<std::size_t>(threads, bufs.size()));
+
+    std::atomic<std::size_t> next(0);
+    auto worker = [&bufs, &elfs, &next]()
+    {
+        while (true)
+        {
+            auto ix = next.fetch_add(1, std::memory_order_relaxed);
+            if (ix >= bufs.size())
+                break;
+
+            ABSL_INTERNAL_TRY
+            {
+                elfs[ix] = ELF::load(bufs[ix]);
+            }
+            ABSL_INTERNAL_CATCH_ANY
+            {
+                elfs[ix] = ELF::ELFOpt::None();
+            }
+        }
+    };
+
+    if (threads <= 1)
+    {
+        worker();
+        return elfs;
+    }
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned i = 1; i < threads; ++i)
+    {
+        // on failure, go on with the workers that did start; this thread
+        // drains the rest and they must be joined before returning
+        ABSL_INTERNAL_TRY
+        {
+            pool.emplace_back(worker);
+        }
+        ABSL_INTERNAL_CATCH_ANY
+        {
+            break;
+        }
+    }
+
+    worker();
+
+    for (auto &t : pool)
+        t.join();
+
+    return elfs;
+}
+
+} // namespace mvpu_elf
+
+#endif // MVPU_ELF_BATCH_LOAD_H
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef MVPU_ELF_CFG_INDEX_H
+#define MVPU_ELF_CFG_INDEX_H
+
+#include "MVPU_ELF/CustomInfo.h"
+#include "MVPU_ELF/ELF.h"
+
+#include "absl/types/span.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace mvpu_elf
+{
+
+// Compressed sparse row form of a ControlFlowGraph. Every distinct basic
+// block gets a dense id (blocks sorted by range), and successors and
+// predecessors of a block are contiguous slices of one id array each.
+class CFGIndex
+{
+public:
+    using BlockID = std::uint32_t;
+    using BlockList = absl::Span<const BlockID>;
+
+    static constexpr BlockID npos = ~BlockID(0);
+
+    CFGIndex() = default;
+
+    explicit CFGIndex(const ControlFlowGraph &cfg)
+    {
+        blocks.reserve(cfg.inner.size() * 2);
+        for (auto &edge : cfg.inner)
+        {
+            blocks.push_back(std::get<0>(edge));
+            blocks.push_back(std::get<1>(edge));
+        }
+        std::sort(blocks.begin(), blocks.end());
+        blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+
+        std::vector<BlockID> from, to;
+        from.reserve(cfg.inner.size());
+        to.reserve(cfg.inner.size());
+        for (auto &edge : cfg.inner)
+        {
+            from.push_back(find(std::get<0>(edge)));
+            to.push_back(find(std::get<1>(edge)));
+        }
+
+        buildCSR(from, to, succOffsets, succs);
+        buildCSR(to, from, predOffsets, preds);
+    }
+
+    std::size_t size() const { return blocks.size(); }
+
+    bool empty() const { return blocks.empty(); }
+
+    const BasicBlockRange & block(BlockID id) const { return blocks[id]; }
+
+    absl::Span<const BasicBlockRange> getBlocks() const { return blocks; }
+
+    BlockList successors(BlockID id) const
+    {
+        return BlockList(succs.data() + succOffsets[id], succOffsets[id + 1] - succOffsets[id]);
+    }
+
+    BlockList predecessors(BlockID id) const
+    {
+        return BlockList(preds.data() + predOffsets[id], predOffsets[id + 1] - predOffsets[id]);
+    }
+
+    // id of the given block, or npos
+    BlockID find(const BasicBlockRange &bb) const
+    {
+        auto it = std::lower_bound(blocks.begin(), blocks.end(), bb);
+        if (it == blocks.end() || !(*it == bb))
+            return npos;
+        return static_cast<BlockID>(it - blocks.begin());
+    }
+
+    // id of the block whose [first, last] contains pc, or npos
+    BlockID findPC(std::uint32_t pc) const
+    {
+        auto it = std::upper_bound(blocks.begin(), blocks.end(), pc,
+                                   [](std::uint32_t p, const BasicBlockRange &bb)
+                                   {
+                                       return p < bb.first;
+                                   });
+        // blocks do not overlap, so only the last block starting at or
+        // before pc can contain it
+        if (it == blocks.begin() || pc > (it - 1)->last)
+            return npos;
+        return static_cast<BlockID>(it - 1 - blocks.begin());
+    }
+
+private:
+    void buildCSR(const std::vector<BlockID> &src, const std::vector<BlockID> &dst,
+                  std::vector<std::uint32_t> &offsets, std::vector<BlockID> &targets) const
+    {
+        offsets.assign(blocks.size() + 1, 0);
+        for (auto s : src)
+            offsets[s + 1] += 1;
+        for (std::size_t i = 1; i < offsets.size(); ++i)
+            offsets[i] += offsets[i - 1];
+
+        targets.resize(dst.size());
+        std::vector<std::uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for (std::size_t i = 0; i < src.size(); ++i)
+            targets[fill[src[i]]++] = dst[i];
+    }
+
+    std::vector<BasicBlockRange> blocks;
+    std::vector<std::uint32_t> succOffsets;
+    std::vector<BlockID> succs;
+    std::vector<std::uint32_t> predOffsets;
+    std::vector<BlockID> preds;
+}; // class CFGIndex
+
+inline CFGIndex makeCFGIndex(const ELF &elf)
+{
+    if (!elf.hasCFGInfo())
+        return CFGIndex();
+    return CFGIndex(elf.getCFGInfo());
+}
+
+} // namespace mvpu_elf
+
+#endif // MVPU_ELF_CFG_INDEX_H
@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 
 namespace mvpu_elf
 {
@@ -244,6 +245,16 @@ private:
     TextOpt text;
 }; // class ELF
 
+// Shared handle to an immutable ELF. ELF::load decodes every section up
+// front and the const interface never mutates, so one view may be read
+// from many threads at once without locking.
+using ELFView = std::shared_ptr<const ELF>;
+
+inline ELFView makeELFView(ELF &&elf)
+{
+    return std::make_shared<const ELF>(std::move(elf));
+}
+
 } // namespace mvpu_elf
 
 #endif // MVPU_ELF_ELF_H
@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef MVPU_ELF_ELF_CACHE_H
+#define MVPU_ELF_ELF_CACHE_H
+
+#include "MVPU_ELF/CustomInfo.h"
+#include "MVPU_ELF/ELF.h"
+#include "MVPU_ELF/RawImage.h"
+
+#include "absl/hash/hash.h"
+#include "absl/strings/string_view.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mvpu_elf
+{
+
+// The bytes of an ELF image with its .mvpu.dbg.id section left out, so
+// kernels built from the same source under different DebugInfoIDs compare
+// equal. Refers to the image; it must outlive the content.
+struct ImageContent
+{
+    absl::string_view head; // before .mvpu.dbg.id, or the whole image
+    absl::string_view tail; // after .mvpu.dbg.id
+
+    static ImageContent of(ELF::RawData image)
+    {
+        ImageContent content;
+        content.head = absl::string_view(reinterpret_cast<const char *>(image.data()), image.size());
+
+        auto img = raw::Image::open(image);
+        raw::Section sec;
+        if (   img.hasVal()
+            && img.getVal().findSection(DBG_ID_SECTION_NAME, sec)
+            && sec.type != raw::NOBITS_SECTION_TYPE
+            && img.getVal().hasContents(sec))
+        {
+            content.tail = content.head.substr(sec.offset + sec.size);
+            content.head = content.head.substr(0, sec.offset);
+        }
+        return content;
+    }
+
+    // not collision resistant; only picks the bucket, bytes are compared
+    std::size_t hash() const
+    {
+        return absl::Hash<std::pair<absl::string_view, absl::string_view>>{}(
+            std::make_pair(head, tail));
+    }
+};
+
+// Shares one parsed, immutable ELF between all loads of images that are
+// identical apart from their DebugInfoID. The shared ELF reports the id of
+// whichever image was loaded first; callers that need the id of their own
+// image should keep it alongside the view (e.g. as the DebugInfoList key).
+// Entries are held weakly, so an ELF is freed once its last user drops it.
+//
+// Images may come from untrusted app caches, so a hit requires the cached
+// bytes to match, not just the hash. Each live entry keeps a copy of its
+// image (less the .mvpu.dbg.id bytes) for that comparison.
+class ELFCache
+{
+public:
+    static ELFCache & global()
+    {
+        static ELFCache cache;
+        return cache;
+    }
+
+    // nullptr if the image does not load
+    ELFView load(ELF::RawData image)
+    {
+        auto content = ImageContent::of(image);
+        auto key = content.hash();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (auto *entry = find(key, content))
+            {
+                if (auto elf = entry->elf.lock())
+                    return elf;
+            }
+        }
+
+        auto loaded = ELF::load(image);
+        if (!loaded.hasVal())
+            return nullptr;
+
+        auto elf = makeELFView(std::move(loaded.getVal()));
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (auto *entry = find(key, content))
+        {
+            if (auto other = entry->elf.lock())
+                return other;
+
+            entry->elf = elf;
+            return elf;
+        }
+
+        Entry entry;
+        entry.head.assign(content.head.data(), content.head.size());
+        entry.tail.assign(content.tail.data(), content.tail.size());
+        entry.elf = elf;
+        elfs[key].push_back(std::move(entry));
+        ++count;
+        prune();
+        return elf;
+    }
+
+    std::size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return count;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        elfs.clear();
+        count = 0;
+    }
+
+private:
+    struct Entry
+    {
+        std::string head;
+        std::string tail;
+        std::weak_ptr<const ELF> elf;
+    };
+
+    Entry * find(std::size_t key, const ImageContent &content)
+    {
+        auto it = elfs.find(key);
+        if (it == elfs.end())
+            return nullptr;
+
+        for (auto &entry : it->second)
+        {
+            if (entry.head == content.head && entry.tail == content.tail)
+                return &entry;
+        }
+        return nullptr;
+    }
+
+    void prune()
+    {
+        // amortized: only sweep once the cache has doubled since the last sweep
+        if (count < pruneAt)
+            return;
+
+        for (auto it = elfs.begin(); it != elfs.end();)
+        {
+            auto &bucket = it->second;
+            auto live = std::remove_if(bucket.begin(), bucket.end(),
+                                       [](const Entry &entry) { return entry.elf.expired(); });
+            count -= static_cast<std::size_t>(bucket.end() - live);
+            bucket.erase(live, bucket.end());
+
+            if (bucket.empty())
+                it = elfs.erase(it);
+            else
+                ++it;
+        }
+        pruneAt = count * 2 + 16;
+    }
+
+    mutable std::mutex mutex;
+    // keyed by ImageContent::hash(); entries in a bucket differ in content
+    std::unordered_map<std::size_t, std::vector<Entry>> elfs;
+    std::size_t count = 0;
+    std::size_t pruneAt = 16;
+}; // class ELFCache
+
+} // namespace mvpu_elf
+
+#endif // MVPU_ELF_ELF_CACHE_H
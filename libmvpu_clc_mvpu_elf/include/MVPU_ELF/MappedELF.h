@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef MVPU_ELF_MAPPED_ELF_H
+#define MVPU_ELF_MAPPED_ELF_H
+
+#include "MVPU_ELF/ELF.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+
+namespace mvpu_elf
+{
+
+// Loads a kernel .elf file through a temporary read-only mapping instead
+// of reading it into a heap buffer first. ELF::load keeps its own copy of
+// the input, so the mapping is released as soon as it returns and the
+// returned ELF does not refer to the file.
+inline ELF::ELFOpt loadMapped(const char *path)
+{
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return ELF::ELFOpt::None();
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        ::close(fd);
+        return ELF::ELFOpt::None();
+    }
+
+    auto len = static_cast<std::size_t>(st.st_size);
+    void *ptr = ::mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (ptr == MAP_FAILED)
+        return ELF::ELFOpt::None();
+
+    auto elf = ELF::load(ELF::RawData(static_cast<const unsigned char *>(ptr), len));
+
+    ::munmap(ptr, len);
+    return elf;
+}
+
+} // namespace mvpu_elf
+
+#endif // MVPU_ELF_MAPPED_ELF_H
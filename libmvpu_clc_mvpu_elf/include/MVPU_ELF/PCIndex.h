@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef MVPU_ELF_PC_INDEX_H
+#define MVPU_ELF_PC_INDEX_H
+
+#include "MVPU_ELF/CustomInfo.h"
+#include "MVPU_ELF/ELF.h"
+
+#include "absl/types/span.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace mvpu_elf
+{
+
+// (pc, slot) packed so that it orders like the operator< of the records
+inline std::uint64_t pcKey(std::uint32_t pc, std::uint8_t slot)
+{
+    return (static_cast<std::uint64_t>(pc) << 8) | slot;
+}
+
+inline std::uint64_t pcKey(const LatencyInfoLoc &loc) { return pcKey(loc.loc.pc, loc.loc.slot); }
+
+inline std::uint64_t pcKey(const SpillLoc &loc) { return pcKey(loc.pc, loc.slot); }
+
+inline std::uint64_t pcKey(const SWPLoc &loc) { return pcKey(loc.pc, 0); }
+
+// Sorted flat index over a debug info record list. The keys are kept in
+// their own array so lookups only touch 8 bytes per probe. The index
+// refers to the records it was built from, which must outlive it.
+template <typename T>
+class PCIndex
+{
+public:
+    using Entries = absl::Span<const T * const>;
+
+    PCIndex() = default;
+
+    explicit PCIndex(const std::vector<T> &records)
+    {
+        std::vector<std::pair<std::uint64_t, const T *>> sorted;
+        sorted.reserve(records.size());
+        for (auto &rec : records)
+            sorted.emplace_back(pcKey(rec), &rec);
+
+        std::stable_sort(sorted.begin(), sorted.end(),
+                         [](const std::pair<std::uint64_t, const T *> &a,
+                            const std::pair<std::uint64_t, const T *> &b)
+                         {
+                             return a.first < b.first;
+                         });
+
+        keys.reserve(sorted.size());
+        entries.reserve(sorted.size());
+        for (auto &pair : sorted)
+        {
+            keys.push_back(pair.first);
+            entries.push_back(pair.second);
+        }
+    }
+
+    std::size_t size() const { return keys.size(); }
+
+    bool empty() const { return keys.empty(); }
+
+    // records at exactly (pc, slot), in their original order
+    Entries find(std::uint32_t pc, std::uint8_t slot) const
+    {
+        auto key = pcKey(pc, slot);
+        return slice(key, key + 1);
+    }
+
+    // records at pc, any slot
+    Entries findPC(std::uint32_t pc) const
+    {
+        return slice(pcKey(pc, 0), pcKey(pc, 0) + 0x100);
+    }
+
+    // records with pcBegin <= pc < pcEnd
+    Entries inRange(std::uint32_t pcBegin, std::uint32_t pcEnd) const
+    {
+        if (pcEnd <= pcBegin)
+            return Entries();
+        return slice(pcKey(pcBegin, 0), pcKey(pcEnd, 0));
+    }
+
+private:
+    Entries slice(std::uint64_t lo, std::uint64_t hi) const
+    {
+        auto first = std::lower_bound(keys.begin(), keys.end(), lo);
+        auto last = std::lower_bound(first, keys.end(), hi);
+        auto pos = static_cast<std::size_t>(first - keys.begin());
+        auto len = static_cast<std::size_t>(last - first);
+        return Entries(entries.data() + pos, len);
+    }
+
+    std::vector<std::uint64_t> keys;
+    std::vector<const T *> entries;
+}; // class PCIndex
+
+using LatencyIndex = PCIndex<LatencyInfoLoc>;
+using SpillIndex = PCIndex<SpillLoc>;
+using SWPIndex = PCIndex<SWPLoc>;
+
+inline LatencyIndex makeLatencyIndex(const ELF &elf)
+{
+    if (!elf.hasLatencyInfo())
+        return LatencyIndex();
+    return LatencyIndex(elf.getLatencyInfo().inner);
+}
+
+inline SpillIndex makeSpillIndex(const ELF &elf)
+{
+    if (!elf.hasSpillInfo())
+        return SpillIndex();
+    return SpillIndex(elf.getSpillInfo().inner);
+}
+
+inline SWPIndex makeSWPIndex(const ELF &elf)
+{
+    if (!elf.hasSWPInfo())
+        return SWPIndex();
+    return SWPIndex(elf.getSWPInfo().inner);
+}
+
+} // namespace mvpu_elf
+
+#endif // MVPU_ELF_PC_INDEX_H
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef MVPU_ELF_PATCH_H
+#define MVPU_ELF_PATCH_H
+
+#include "MVPU_ELF/RawImage.h"
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace mvpu_elf { namespace raw {
+
+// Edits of a saved ELF image that touch only the changed section and its
+// section header entry, instead of a full ELF::load / ELF::save cycle.
+// `data` must not point into `image`.
+
+// Overwrites the contents of a section in place. Fails unless the new
+// contents have exactly the size of the old ones.
+inline bool patchSection(absl::Span<unsigned char> image, absl::string_view name,
+                         absl::Span<const unsigned char> data)
+{
+    auto imgOpt = Image::open(image);
+    if (!imgOpt.hasVal())
+        return false;
+    auto &img = imgOpt.getVal();
+
+    Section sec;
+    if (!img.findSection(name, sec))
+        return false;
+    if (sec.type == NOBITS_SECTION_TYPE || !img.hasContents(sec) || sec.size != data.size())
+        return false;
+
+    if (!data.empty())
+        std::memcpy(image.data() + sec.offset, data.data(), data.size());
+    return true;
+}
+
+// Replaces the contents of a section. Contents that fit are written in
+// place; larger contents are appended to the end of the image and the
+// section header entry is pointed at them, leaving the old bytes unused.
+// Sections that are part of the loaded image (SHF_ALLOC) can only be
+// rewritten in place, since moving them would desync the program headers.
+inline bool updateSection(std::vector<unsigned char> &image, absl::string_view name,
+                          absl::Span<const unsigned char> data)
+{
+    auto imgOpt = Image::open(image);
+    if (!imgOpt.hasVal())
+        return false;
+    auto img = imgOpt.getVal();
+
+    Section sec;
+    if (!img.findSection(name, sec))
+        return false;
+    if (sec.type == NOBITS_SECTION_TYPE || !img.hasContents(sec))
+        return false;
+
+    if (data.size() == sec.size || (data.size() < sec.size && !(sec.flags & ALLOC_SECTION_FLAG)))
+    {
+        if (!data.empty())
+            std::memcpy(image.data() + sec.offset, data.data(), data.size());
+        if (data.size() != sec.size)
+            img.writeSectionRange(absl::MakeSpan(image), sec, sec.offset, data.size());
+        return true;
+    }
+
+    if (sec.flags & ALLOC_SECTION_FLAG)
+        return false;
+
+    std::uint64_t align = std::max<std::uint64_t>(sec.align, 1);
+    std::uint64_t offset = (image.size() + align - 1) / align * align;
+    if (offset < image.size() || data.size() > img.getMaxOffset() - offset)
+        return false;
+
+    image.resize(offset + data.size(), 0);
+    if (!data.empty())
+        std::memcpy(image.data() + offset, data.data(), data.size());
+
+    // the header table did not move, only the vector storage may have
+    img.writeSectionRange(absl::MakeSpan(image), sec, offset, data.size());
+    return true;
+}
+
+}} // namespace mvpu_elf::raw
+
+#endif // MVPU_ELF_PATCH_H
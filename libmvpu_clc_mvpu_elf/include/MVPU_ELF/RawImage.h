@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef MVPU_ELF_RAW_IMAGE_H
+#define MVPU_ELF_RAW_IMAGE_H
+
+#include "PrimeLib/Option.h"
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace mvpu_elf { namespace raw {
+
+// Bounds-checked, allocation-free reader of the ELF header and section
+// header table of an image, for callers that need to inspect or patch the
+// bytes without going through ELF::load.
+
+struct Section
+{
+    absl::string_view name;
+    std::uint32_t type;
+    std::uint64_t flags;
+    std::uint64_t addr;
+    std::uint64_t offset;
+    std::uint64_t size;
+    std::uint64_t align;
+    std::uint64_t headerOffset; // of this entry in the section header table
+};
+
+const std::uint32_t NOBITS_SECTION_TYPE = 8;
+const std::uint64_t ALLOC_SECTION_FLAG = 0x2;
+
+class Image
+{
+public:
+    using RawData = absl::Span<const unsigned char>;
+    using ImageOpt = prime_lib::Option<Image>;
+
+    static ImageOpt open(RawData buf)
+    {
+        Image img;
+        img.buf = buf;
+
+        if (buf.size() < 16)
+            return ImageOpt::None();
+        if (buf[0] != 0x7f || buf[1] != 'E' || buf[2] != 'L' || buf[3] != 'F')
+            return ImageOpt::None();
+
+        switch (buf[4])
+        {
+        default: return ImageOpt::None();
+        case 1: img.wide = false; break;
+        case 2: img.wide = true; break;
+        }
+
+        switch (buf[5])
+        {
+        default: return ImageOpt::None();
+        case 1: img.lsb = true; break;
+        case 2: img.lsb = false; break;
+        }
+
+        if (buf.size() < img.ehdrSize())
+            return ImageOpt::None();
+
+        auto phoff = img.wide ? img.read64(32) : img.read32(28);
+        std::uint64_t phentsize = img.read16(img.wide ? 54 : 42);
+        std::uint64_t phnum = img.read16(img.wide ? 56 : 44);
+        if (phoff != 0 && phnum != 0)
+        {
+            if (phentsize < img.phdrSize() || !img.inFile(phoff, phentsize * phnum))
+                return ImageOpt::None();
+        }
+
+        img.shoff = img.wide ? img.read64(40) : img.read32(32);
+        img.shentsize = img.read16(img.wide ? 58 : 46);
+        img.shnum = img.read16(img.wide ? 60 : 48);
+        img.shstrndx = img.read16(img.wide ? 62 : 50);
+
+        if (img.shoff == 0)
+        {
+            // no section header table
+            img.shnum = 0;
+            return ImageOpt::Some(img);
+        }
+
+        if (img.shentsize < img.shdrSize())
+            return ImageOpt::None();
+        if (!img.inFile(img.shoff, img.shentsize))
+            return ImageOpt::None();
+
+        // extended numbering keeps the real values in section 0
+        if (img.shnum == 0)
+            img.shnum = img.wide ? img.read64(img.shoff + 32) : img.read32(img.shoff + 20);
+        if (img.shstrndx == 0xffff)
+            img.shstrndx = img.read32(img.shoff + (img.wide ? 40 : 24));
+
+        if (img.shnum > (buf.size() - img.shoff) / img.shentsize)
+            return ImageOpt::None();
+
+        if (img.shstrndx != 0)
+        {
+            if (img.shstrndx >= img.shnum)
+                return ImageOpt::None();
+
+            auto hdr = img.shoff + img.shstrndx * img.shentsize;
+            img.strOff = img.wide ? img.read64(hdr + 24) : img.read32(hdr + 16);
+            img.strSize = img.wide ? img.read64(hdr + 32) : img.read32(hdr + 20);
+            if (!img.inFile(img.strOff, img.strSize))
+                return ImageOpt::None();
+        }
+
+        return ImageOpt::Some(img);
+    }
+
+    bool is64() const { return wide; }
+
+    bool isLSB() const { return lsb; }
+
+    std::uint16_t getType() const { return read16(16); }
+
+    std::uint16_t getMachine() const { return read16(18); }
+
+    std::uint64_t getSectionCount() const { return shnum; }
+
+    RawData getData() const { return buf; }
+
+    // false if the entry is out of range or its name is malformed
+    bool getSection(std::uint64_t ix, Section &sec) const
+    {
+        if (ix >= shnum)
+            return false;
+
+        auto hdr = shoff + ix * shentsize;
+        auto nameOff = read32(hdr);
+
+        sec.headerOffset = hdr;
+        sec.type = read32(hdr + 4);
+        if (wide)
+        {
+            sec.flags  = read64(hdr + 8);
+            sec.addr   = read64(hdr + 16);
+            sec.offset = read64(hdr + 24);
+            sec.size   = read64(hdr + 32);
+            sec.align  = read64(hdr + 48);
+        }
+        else
+        {
+            sec.flags  = read32(hdr + 8);
+            sec.addr   = read32(hdr + 12);
+            sec.offset = read32(hdr + 16);
+            sec.size   = read32(hdr + 20);
+            sec.align  = read32(hdr + 32);
+        }
+
+        sec.name = absl::string_view();
+        if (strSize == 0)
+            return nameOff == 0;
+        if (nameOff >= strSize)
+            return false;
+
+        auto str = reinterpret_cast<const char *>(buf.data() + strOff + nameOff);
+        auto end = static_cast<const char *>(std::memchr(str, 0, strSize - nameOff));
+        if (!end)
+            return false;
+
+        sec.name = absl::string_view(str, end - str);
+        return true;
+    }
+
+    bool findSection(absl::string_view name, Section &sec) const
+    {
+        for (std::uint64_t ix = 1; ix < shnum; ++ix)
+        {
+            if (getSection(ix, sec) && sec.name == name)
+                return true;
+        }
+        return false;
+    }
+
+    // whether the section's bytes lie inside the image
+    bool hasContents(const Section &sec) const
+    {
+        return sec.type == NOBITS_SECTION_TYPE || inFile(sec.offset, sec.size);
+    }
+
+    // rewrites the offset and size of a section header entry in out
+    void writeSectionRange(absl::Span<unsigned char> out, const Section &sec,
+                           std::uint64_t offset, std::uint64_t size) const
+    {
+        if (wide)
+        {
+            write(out, sec.headerOffset + 24, offset, 8);
+            write(out, sec.headerOffset + 32, size, 8);
+        }
+        else
+        {
+            write(out, sec.headerOffset + 16, offset, 4);
+            write(out, sec.headerOffset + 20, size, 4);
+        }
+    }
+
+    std::uint64_t getMaxOffset() const
+    {
+        return wide ? ~std::uint64_t(0) : 0xffffffffu;
+    }
+
+private:
+    std::uint64_t ehdrSize() const { return wide ? 64 : 52; }
+
+    std::uint64_t shdrSize() const { return wide ? 64 : 40; }
+
+    std::uint64_t phdrSize() const { return wide ? 56 : 32; }
+
+    bool inFile(std::uint64_t off, std::uint64_t len) const
+    {
+        return off <= buf.size() && len <= buf.size() - off;
+    }
+
+    std::uint64_t read(std::uint64_t off, unsigned bytes) const
+    {
+        std::uint64_t val = 0;
+        for (unsigned i = 0; i < bytes; ++i)
+        {
+            std::uint64_t b = buf[off + (lsb ? i : bytes - 1 - i)];
+            val |= b << (8 * i);
+        }
+        return val;
+    }
+
+    void write(absl::Span<unsigned char> out, std::uint64_t off, std::uint64_t val, unsigned bytes) const
+    {
+        for (unsigned i = 0; i < bytes; ++i)
+            out[off + (lsb ? i : bytes - 1 - i)] = static_cast<unsigned char>(val >> (8 * i));
+    }
+
+    std::uint16_t read16(std::uint64_t off) const { return static_cast<std::uint16_t>(read(off, 2)); }
+
+    std::uint32_t read32(std::uint64_t off) const { return static_cast<std::uint32_t>(read(off, 4)); }
+
+    std::uint64_t read64(std::uint64_t off) const { return read(off, 8); }
+
+    RawData buf;
+    bool wide = false;
+    bool lsb = true;
+    std::uint64_t shoff = 0;
+    std::uint64_t shentsize = 0;
+    std::uint64_t shnum = 0;
+    std::uint64_t shstrndx = 0;
+    std::uint64_t strOff = 0;
+    std::uint64_t strSize = 0;
+}; // class Image
+
+}} // namespace mvpu_elf::raw
+
+#endif // MVPU_ELF_RAW_IMAGE_H
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef MVPU_ELF_SECTION_TABLE_H
+#define MVPU_ELF_SECTION_TABLE_H
+
+#include "MVPU_ELF/ELF.h"
+
+#include "absl/strings/string_view.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace mvpu_elf
+{
+
+// Name-sorted snapshot of the raw sections of an ELF. Built once, it
+// answers lookups by string_view without allocating. The data spans point
+// into the ELF, which must outlive the table and not be modified.
+class SectionTable
+{
+public:
+    using RawData = ELF::RawData;
+
+    struct Entry
+    {
+        std::string name;
+        RawData data;
+    };
+
+    using const_iterator = std::vector<Entry>::const_iterator;
+
+    SectionTable() = default;
+
+    explicit SectionTable(const ELF &elf)
+    {
+        auto names = elf.getSectionNames();
+        entries.reserve(names.size());
+        for (auto &name : names)
+        {
+            auto data = elf.getSection(name);
+            entries.push_back(Entry{std::move(name), data});
+        }
+
+        std::sort(entries.begin(), entries.end(),
+                  [](const Entry &a, const Entry &b) { return a.name < b.name; });
+    }
+
+    const_iterator begin() const { return entries.begin(); }
+
+    const_iterator end() const { return entries.end(); }
+
+    std::size_t size() const { return entries.size(); }
+
+    bool empty() const { return entries.empty(); }
+
+    const Entry * find(absl::string_view name) const
+    {
+        auto it = std::lower_bound(entries.begin(), entries.end(), name,
+                                   [](const Entry &e, absl::string_view n)
+                                   {
+                                       return absl::string_view(e.name) < n;
+                                   });
+        if (it == entries.end() || it->name != name)
+            return nullptr;
+        return &*it;
+    }
+
+    bool hasSection(absl::string_view name) const { return find(name) != nullptr; }
+
+    RawData getSection(absl::string_view name) const
+    {
+        auto entry = find(name);
+        return entry ? entry->data : RawData();
+    }
+
+    std::size_t getSectionSize(absl::string_view name) const
+    {
+        return getSection(name).size();
+    }
+
+private:
+    std::vector<Entry> entries;
+}; // class SectionTable
+
+} // namespace mvpu_elf
+
+#endif // MVPU_ELF_SECTION_TABLE_H
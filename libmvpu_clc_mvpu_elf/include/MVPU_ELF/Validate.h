@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef MVPU_ELF_VALIDATE_H
+#define MVPU_ELF_VALIDATE_H
+
+#include "MVPU_ELF/CustomInfo.h"
+#include "MVPU_ELF/ELF.h"
+#include "MVPU_ELF/RawImage.h"
+
+#include "absl/strings/match.h"
+#include "absl/strings/string_view.h"
+
+#include <cstdint>
+
+namespace mvpu_elf
+{
+
+// Cheap structural check of an untrusted image, without allocating or
+// decoding any section: header, program and section header table bounds,
+// section name table, machine and type, and that every section with
+// contents (in particular the .mvpu.dbg.* ones) lies inside the image.
+// Passing it does not guarantee that ELF::load succeeds; an image that
+// fails it is not a usable MVPU kernel binary.
+inline bool validate(ELF::RawData buf)
+{
+    auto imgOpt = raw::Image::open(buf);
+    if (!imgOpt.hasVal())
+        return false;
+    auto &img = imgOpt.getVal();
+
+    switch (static_cast<Machine>(img.getMachine()))
+    {
+    default: return false;
+    case Machine::MTKRV5:
+    case Machine::MTKVPU:
+        break;
+    }
+
+    switch (static_cast<Type>(img.getType()))
+    {
+    default: return false;
+    case Type::REL:
+    case Type::EXEC:
+    case Type::DYN:
+        break;
+    }
+
+    raw::Section sec;
+    for (std::uint64_t ix = 1; ix < img.getSectionCount(); ++ix)
+    {
+        if (!img.getSection(ix, sec) || !img.hasContents(sec))
+            return false;
+
+        // custom sections are decoded from file contents
+        bool custom =    absl::StartsWith(sec.name, ".mvpu.dbg.")
+                      || sec.name == COMMENT_SECTION_NAME;
+        if (custom && sec.type == raw::NOBITS_SECTION_TYPE)
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace mvpu_elf
+
+#endif // MVPU_ELF_VALIDATE_H